@@ -7,10 +7,13 @@
 #include "ImmutRef.hpp"
 #include "MutRef.hpp"
 #include "internal/ARC.hpp"
+#include <concepts>
 #include <format>
+#include <functional>
 #include <iostream>
 #include <optional>
 #include <thread>
+#include <utility>
 
 namespace safe {
 /**
@@ -75,6 +78,35 @@ public:
         return access_waiting(&AccessManager::mut_optional, retry, timeout);
     }
 
+    /**
+     * @brief Borrow a mutable reference to the managed value once the predicate on it holds
+     *
+     * Unlike @link mut_waiting @endlink, doesn't poll but blocks until woken up by a release of another reference.
+     * The predicate is re-checked only after a mutable reference to the value has been released.
+     * Which waiters are woken up is controlled by @link MutRef::notify_on_release @endlink.
+     *
+     * @param pred Predicate on the managed value. Must not borrow references from this manager.
+     * @param deadline Point in time after which it exits forcefully
+     *
+     * @throws std::runtime_error if and only if the deadline has been reached
+     */
+    template <std::predicate<const T &> Pred>
+    [[nodiscard]] constexpr MutRef<T> mut_when(Pred &&pred, const std::chrono::system_clock::time_point &deadline);
+
+    /**
+     * @brief Borrow a mutable reference to the managed value once the predicate on it holds
+     *
+     * Same as the overload taking a deadline.
+     *
+     * @param timeout Timeout after which it exits forcefully.
+     *                If @p nullopt given, it waits indefinitely.
+     *
+     * @throws std::runtime_error if and only if timeout is given and has exceeded
+     */
+    template <std::predicate<const T &> Pred>
+    [[nodiscard]] constexpr MutRef<T>
+    mut_when(Pred &&pred, const std::optional<std::chrono::system_clock::duration> &timeout = std::nullopt);
+
     /**
      * @brief Borrow an immutable reference to the managed value
      *
@@ -110,12 +142,49 @@ public:
         return access_waiting(&AccessManager::immut_optional, retry, timeout);
     }
 
+    /**
+     * @brief Borrow an immutable reference to the managed value once the predicate on it holds
+     *
+     * Same as @link mut_when @endlink, but other immutable references don't prevent the borrow.
+     *
+     * @throws std::runtime_error if and only if the deadline has been reached
+     */
+    template <std::predicate<const T &> Pred>
+    [[nodiscard]] constexpr ImmutRef<T> immut_when(Pred &&pred,
+                                                   const std::chrono::system_clock::time_point &deadline);
+
+    /**
+     * @brief Borrow an immutable reference to the managed value once the predicate on it holds
+     *
+     * Same as the overload taking a deadline.
+     *
+     * @throws std::runtime_error if and only if timeout is given and has exceeded
+     */
+    template <std::predicate<const T &> Pred>
+    [[nodiscard]] constexpr ImmutRef<T>
+    immut_when(Pred &&pred, const std::optional<std::chrono::system_clock::duration> &timeout = std::nullopt);
+
 private:
     [[nodiscard]] constexpr auto
     access_waiting(auto &&access,
                    const std::chrono::system_clock::duration &retry,
                    const std::optional<std::chrono::system_clock::duration> &timeout = std::nullopt);
 
+    /**
+     * @brief Block until the reference is registered by @p register_reference
+     *
+     * @throws std::runtime_error if the deadline has been reached
+     */
+    constexpr void register_when(auto &&register_reference,
+                                 auto &pred,
+                                 const std::optional<std::chrono::system_clock::time_point> &deadline);
+
+    [[nodiscard]] static constexpr std::optional<std::chrono::system_clock::time_point>
+    deadline_after(const std::optional<std::chrono::system_clock::duration> &timeout) {
+        if (timeout) return std::chrono::system_clock::now() + *timeout;
+        return std::nullopt;
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const AccessManager &bc) noexcept {
         return os << std::format("BorrowChecker(mutable = {}, immutable = {})",
                                  bc._tracker.mutable_registered() ? "yes" : "no",
@@ -203,6 +272,50 @@ constexpr auto AccessManager<T>::access_waiting(auto &&access,
 
     throw std::runtime_error("Timeout exceeded");
 }
+
+template <typename T>
+    requires(!std::is_reference_v<T>)
+template <std::predicate<const T &> Pred>
+constexpr MutRef<T> AccessManager<T>::mut_when(Pred &&pred, const std::chrono::system_clock::time_point &deadline) {
+    register_when(&internal::ARC::register_mutable_when, pred, deadline);
+    return MutRef(_value, _tracker);
+}
+
+template <typename T>
+    requires(!std::is_reference_v<T>)
+template <std::predicate<const T &> Pred>
+constexpr MutRef<T> AccessManager<T>::mut_when(Pred &&pred,
+                                               const std::optional<std::chrono::system_clock::duration> &timeout) {
+    register_when(&internal::ARC::register_mutable_when, pred, deadline_after(timeout));
+    return MutRef(_value, _tracker);
+}
+
+template <typename T>
+    requires(!std::is_reference_v<T>)
+template <std::predicate<const T &> Pred>
+constexpr ImmutRef<T> AccessManager<T>::immut_when(Pred &&pred,
+                                                   const std::chrono::system_clock::time_point &deadline) {
+    register_when(&internal::ARC::register_immutable_when, pred, deadline);
+    return ImmutRef(_value, _tracker);
+}
+
+template <typename T>
+    requires(!std::is_reference_v<T>)
+template <std::predicate<const T &> Pred>
+constexpr ImmutRef<T> AccessManager<T>::immut_when(Pred &&pred,
+                                                   const std::optional<std::chrono::system_clock::duration> &timeout) {
+    register_when(&internal::ARC::register_immutable_when, pred, deadline_after(timeout));
+    return ImmutRef(_value, _tracker);
+}
+
+template <typename T>
+    requires(!std::is_reference_v<T>)
+constexpr void AccessManager<T>::register_when(auto &&register_reference,
+                                               auto &pred,
+                                               const std::optional<std::chrono::system_clock::time_point> &deadline) {
+    const auto condition = [this, &pred] { return std::invoke(pred, std::as_const(_value)); };
+    if (!(_tracker.*register_reference)(condition, deadline)) throw std::runtime_error("Timeout exceeded");
+}
 } // namespace safe
 
 #endif // SAFE_ACCESS_MANAGER_HPP
@@ -18,21 +18,26 @@ template <typename T>
     requires(!std::is_reference_v<T>)
 class MutRef {
 public:
+    using Notify = internal::ARC::Notify;
+
     MutRef() = delete;
 
     MutRef(const MutRef &) noexcept            = delete;
     MutRef &operator=(const MutRef &) noexcept = delete;
 
-    MutRef(MutRef &&other) noexcept : _ref(other._ref), _tracker(other._tracker) { other._tracker = nullptr; }
+    MutRef(MutRef &&other) noexcept : _ref(other._ref), _tracker(other._tracker), _notify(other._notify) {
+        other._tracker = nullptr;
+    }
 
     MutRef &operator=(MutRef &&other) noexcept {
         _ref = other._ref;
         std::swap(_tracker, other._tracker);
+        std::swap(_notify, other._notify);
         return *this;
     }
 
     ~MutRef() noexcept {
-        if (_tracker && !_tracker->unregister_mutable()) {
+        if (_tracker && !_tracker->unregister_mutable(_notify)) {
             std::cerr << "Double release of a mutable reference" << std::endl;
             exit(161);
         }
@@ -50,9 +55,19 @@ public:
      */
     [[nodiscard]] constexpr T *operator->() noexcept { return &_ref; }
 
+    /**
+     * @brief Choose which threads waiting in @p mut_when / @p immut_when are woken up on release
+     *
+     * By default all of them are woken up.
+     * @p Notify::ONE suits the case when the change made through this reference can satisfy only one waiter,
+     * e.g. a single element pushed to a queue.
+     */
+    constexpr void notify_on_release(const Notify notify) noexcept { _notify = notify; }
+
 private:
-    T &_ref;                 ///< Reference to the tracked object
-    internal::ARC *_tracker; ///< Counter shared among all references to the object
+    T &_ref;                      ///< Reference to the tracked object
+    internal::ARC *_tracker;      ///< Counter shared among all references to the object
+    Notify _notify = Notify::ALL; ///< Which conditional waiters to wake up on release
 };
 } // namespace safe
 
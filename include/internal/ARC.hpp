@@ -4,7 +4,11 @@
 
 #ifndef SAFE_ARC_HPP
 #define SAFE_ARC_HPP
+#include <chrono>
+#include <condition_variable>
+#include <functional>
 #include <mutex>
+#include <optional>
 
 namespace safe::internal {
 /**
@@ -21,6 +25,11 @@ class ARC {
 public:
     enum struct MutableRegisterStatus { SUCCESS, MUTABLE_EXISTS, IMMUTABLE_EXISTS };
 
+    /**
+     * @brief Which of the conditional waiters are woken up when a mutable reference is released
+     */
+    enum struct Notify { ONE, ALL };
+
     ARC() noexcept = default;
 
     ARC(const ARC &) noexcept            = delete;
@@ -45,14 +54,30 @@ public:
      */
     [[nodiscard]] MutableRegisterStatus register_mutable() noexcept;
 
+    /**
+     * @brief Wait until a mutable reference can be borrowed and the condition holds, then register it
+     *
+     * The condition is evaluated under the internal lock while no mutable reference is registered.
+     * It is re-evaluated only after a mutable reference has been released since the previous evaluation.
+     *
+     * @param condition Predicate on the tracked object. Must not borrow references tracked by this counter.
+     * @param deadline Point in time after which it gives up. If @p nullopt given, it waits indefinitely.
+     *
+     * @return @p false if and only if the deadline has been reached before the registration
+     */
+    [[nodiscard]] bool
+    register_mutable_when(const std::function<bool()> &condition,
+                          const std::optional<std::chrono::system_clock::time_point> &deadline = std::nullopt);
+
     /**
      * @brief Remove the record of the mutable reference
      *
      * In a case of failure does nothing.
+     * On success wakes up conditional waiters according to @p notify.
      *
      * @return @p false if and only if there's no registered mutable reference
      */
-    [[nodiscard]] bool unregister_mutable() noexcept;
+    [[nodiscard]] bool unregister_mutable(Notify notify = Notify::ALL) noexcept;
 
     /**
      * @brief Add a record of an immutable reference
@@ -63,6 +88,17 @@ public:
      */
     [[nodiscard]] bool register_immutable() noexcept;
 
+    /**
+     * @brief Wait until an immutable reference can be borrowed and the condition holds, then register it
+     *
+     * Same as @link register_mutable_when @endlink, but ignores existing immutable references.
+     *
+     * @return @p false if and only if the deadline has been reached before the registration
+     */
+    [[nodiscard]] bool
+    register_immutable_when(const std::function<bool()> &condition,
+                            const std::optional<std::chrono::system_clock::time_point> &deadline = std::nullopt);
+
     /**
      * @brief Remove a record of an immutable reference
      *
@@ -83,9 +119,21 @@ public:
     [[nodiscard]] size_t immutables_counter() const noexcept;
 
 private:
-    bool _mutable_registered   = false; ///< Record of registered mutable reference, at most one at a time
-    size_t _immutables_counter = 0;     ///< Record of registered immutable reference, any number at a time
-    std::mutex _mutex{};                ///< Mutex protecting all register/unregister operations
+    /**
+     * @brief Block until borrowing is allowed and the condition holds, or the deadline is reached
+     *
+     * @param exclusive Whether existing immutable references prevent the borrow
+     */
+    [[nodiscard]] bool wait_when(std::unique_lock<std::mutex> &lock,
+                                 bool exclusive,
+                                 const std::function<bool()> &condition,
+                                 const std::optional<std::chrono::system_clock::time_point> &deadline);
+
+    bool _mutable_registered   = false;  ///< Record of registered mutable reference, at most one at a time
+    size_t _immutables_counter = 0;      ///< Record of registered immutable reference, any number at a time
+    size_t _mutations          = 0;      ///< Number of mutable references released so far
+    std::mutex _mutex{};                 ///< Mutex protecting all register/unregister operations
+    std::condition_variable _released{}; ///< Signaled when a release may let conditional waiters proceed
 };
 
 } // namespace safe::internal
@@ -26,10 +26,23 @@ ARC::MutableRegisterStatus ARC::register_mutable() noexcept {
     return MutableRegisterStatus::SUCCESS;
 }
 
-bool ARC::unregister_mutable() noexcept {
+bool ARC::register_mutable_when(const std::function<bool()> &condition,
+                                const std::optional<std::chrono::system_clock::time_point> &deadline) {
+    std::unique_lock lock(_mutex);
+    if (!wait_when(lock, true, condition, deadline)) return false;
+    _mutable_registered = true;
+    return true;
+}
+
+bool ARC::unregister_mutable(const Notify notify) noexcept {
     std::lock_guard guard(_mutex);
     if (!_mutable_registered) return false;
     _mutable_registered = false;
+    _mutations++;
+    switch (notify) {
+    case Notify::ONE: _released.notify_one(); break;
+    case Notify::ALL: _released.notify_all(); break;
+    }
     return true;
 }
 
@@ -40,10 +53,42 @@ bool ARC::register_immutable() noexcept {
     return true;
 }
 
+bool ARC::register_immutable_when(const std::function<bool()> &condition,
+                                  const std::optional<std::chrono::system_clock::time_point> &deadline) {
+    std::unique_lock lock(_mutex);
+    if (!wait_when(lock, false, condition, deadline)) return false;
+    _immutables_counter++;
+    return true;
+}
+
 bool ARC::unregister_immutable() noexcept {
     std::lock_guard guard(_mutex);
     if (_immutables_counter == 0) return false;
     _immutables_counter--;
+    // The value is unchanged, but mutable conditional waiters may be blocked by immutable references only
+    if (_immutables_counter == 0) _released.notify_all();
+    return true;
+}
+
+bool ARC::wait_when(std::unique_lock<std::mutex> &lock,
+                    const bool exclusive,
+                    const std::function<bool()> &condition,
+                    const std::optional<std::chrono::system_clock::time_point> &deadline) {
+    // The value can only change when a mutable reference is released,
+    // so the result of the condition is cached until the next release
+    std::optional<size_t> evaluated_at;
+    bool satisfied     = false;
+    const auto allowed = [&] {
+        if (_mutable_registered) return false;
+        if (evaluated_at != _mutations) {
+            satisfied    = condition();
+            evaluated_at = _mutations;
+        }
+        return satisfied && (!exclusive || _immutables_counter == 0);
+    };
+
+    if (deadline) return _released.wait_until(lock, *deadline, allowed);
+    _released.wait(lock, allowed);
     return true;
 }
 
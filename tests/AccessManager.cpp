@@ -3,7 +3,10 @@
 //
 #include "AccessManager.hpp"
 
+#include <algorithm>
+#include <deque>
 #include <gtest/gtest.h>
+#include <numeric>
 #include <random>
 #include <thread>
 
@@ -135,6 +138,74 @@ TEST(AccessManager, WaitingSync) {
     EXPECT_EQ(*result.immut(), (std::vector<size_t>{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }));
 }
 
+/// Test synchronization using conditional borrow API
+TEST(AccessManager, ConditionalSync) {
+    safe::AccessManager<std::deque<size_t>> queue{ std::deque<size_t>() };
+    safe::AccessManager<std::vector<size_t>> result{ std::vector<size_t>() };
+
+    const auto consumer = [&queue, &result](const size_t i) {
+        for (size_t j = 0; j < 5; j++) {
+            auto q = queue.mut_when([](const auto &pending) { return !pending.empty(); }, std::chrono::seconds(1));
+            q.notify_on_release(safe::MutRef<std::deque<size_t>>::Notify::ONE);
+            result.mut_waiting(std::chrono::microseconds(100), std::chrono::seconds(1))->push_back(q->front());
+            std::cout << std::format("Thread {}: consumed {}\n", i, q->front()) << std::flush;
+            q->pop_front();
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(4);
+
+        for (size_t i = 0; i < 4; i++) threads.emplace_back(consumer, i);
+
+        for (size_t i = 0; i < 20; i++) {
+            auto q = queue.mut_waiting(std::chrono::microseconds(100), std::chrono::seconds(1));
+            q.notify_on_release(safe::MutRef<std::deque<size_t>>::Notify::ONE);
+            q->push_back(i);
+        }
+    }
+
+    EXPECT_TRUE(queue.immut()->empty());
+    auto consumed = *result.immut();
+    std::ranges::sort(consumed);
+    std::vector<size_t> expected(20);
+    std::iota(expected.begin(), expected.end(), 0);
+    EXPECT_EQ(consumed, expected);
+}
+
+TEST(AccessManager, ConditionalWakeUp) {
+    safe::AccessManager<size_t> version(0);
+
+    std::jthread writer([&version] {
+        for (size_t i = 0; i < 3; i++) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            (*version.mut())++;
+        }
+    });
+
+    const auto x = version.immut_when([](const size_t v) { return v >= 3; }, std::chrono::seconds(1));
+    EXPECT_EQ(*x, 3u);
+}
+
+TEST(AccessManager, ConditionalTimeout) {
+    safe::AccessManager<int> x{ 5 };
+    const auto never = [](const int) { return false; };
+
+    EXPECT_THROW(auto ref = x.mut_when(never, std::chrono::milliseconds(10)), std::runtime_error);
+    EXPECT_THROW(auto ref = x.immut_when(never, std::chrono::system_clock::now() + std::chrono::milliseconds(10)),
+                 std::runtime_error);
+
+    {
+        const auto ref = x.immut();
+        EXPECT_THROW(auto mut_ref = x.mut_when([](const int v) { return v == 5; }, std::chrono::milliseconds(10)),
+                     std::runtime_error)
+            << "Existing immutable reference did not prevent a conditional mutable borrow";
+    }
+
+    EXPECT_EQ(*x.mut_when([](const int v) { return v == 5; }), 5);
+}
+
 safe::MutRef<int> return_mut_ref() {
     safe::AccessManager<int> x(5);
     return x.mut();